@@ -12,11 +12,18 @@
 #include <iostream>
 #include <string>
 #include <cctype>
+#include <atomic>
+#include <utility>
 
 /**
  * @brief The Bigint class is used to represent signed arbitrary precision integers.
  * Currently, the class supports addition (+), subtraction (-), multiplication (*), negation (-), comparison (==, !=, <, <=, >, >=),
  * assignment (=), and stream insertion (<<) operators.
+ *
+ * The digits are held in a copy-on-write buffer with an atomic reference count, so copying a Bigint (including passing it by value)
+ * only shares the buffer and the digits are copied the first time one of the sharing objects is modified. Distinct Bigint objects
+ * that share a buffer can be read and modified from different threads concurrently. As with std::string, a single Bigint object may be
+ * read from many threads at once but must not be modified while other threads are accessing it.
  */
 class Bigint
 {
@@ -25,7 +32,7 @@ public:
      * @brief Construct a new Bigint object with value 0 using default constructor
      *
      */
-    Bigint() : digits("0") {}
+    Bigint() : shared(new SharedDigits("0")) {}
 
     /**
      * @brief Construct a new Bigint object by converting the signed 64-bit integer into a Bigint representation
@@ -34,12 +41,13 @@ public:
      */
     Bigint(const int64_t signed_integer)
     {
-        digits = std::to_string(signed_integer);
+        std::string digits = std::to_string(signed_integer);
         if (digits.front() == '-')
         {
             is_negative = true;
             digits.erase(0, 1);
         }
+        shared = new SharedDigits(std::move(digits));
     }
 
     /**
@@ -49,7 +57,7 @@ public:
      */
     Bigint(const std::string &string_of_digits)
     {
-        digits = string_of_digits;
+        std::string digits = string_of_digits;
 
         // Step 1: Remove any accidental spaces from the input string
         for (int64_t i = 0; i < (int64_t)digits.size(); i++)
@@ -82,14 +90,26 @@ public:
             if (!isdigit(digits.at(i)))
                 throw invalid_string;
         }
+
+        shared = new SharedDigits(std::move(digits));
     }
 
     /**
-     * @brief Construct a new Bigint object based on the value of other (copy constructor)
+     * @brief Construct a new Bigint object based on the value of other (copy constructor). The digits are not copied; both objects
+     * share the same buffer until one of them is modified
      *
      * @param other The Bigint object from which data is being copied from
      */
-    Bigint(const Bigint &other) : is_negative(other.is_negative), digits(other.digits) {}
+    Bigint(const Bigint &other) : is_negative(other.is_negative), shared(other.shared)
+    {
+        shared->reference_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Destroy the Bigint object, freeing the buffer of digits if no other Bigint object shares it
+     *
+     */
+    ~Bigint() { release(); }
 
     /**
      * @brief Addition (+=) operator that accepts a Bigint object and adds its value to the current Bigint object
@@ -115,9 +135,10 @@ public:
         }
 
         // Case 3 (Base case): If x and y are either both positive or negative integers, perform addition character by character
+        std::string &digits = mutable_digits();
         // Indices below (first_index and second_index) are signed integers because we need to know when they become negative for the while-loop to work appropriately
         int64_t first_index = (int64_t)digits.size() - 1;
-        int64_t second_index = (int64_t)other.digits.size() - 1;
+        int64_t second_index = (int64_t)other.digits().size() - 1;
         int64_t carryover = 0;
 
         // The following is the typical algorithm for addition
@@ -131,7 +152,7 @@ public:
             // If the first_index still maps to a valid number in the current Bigint object, first_number gets replaced by the result of the digit-digit addition.
             // Otherwise, an insertion is required
             const bool insertion_required = (first_index >= 0) ? false : true;
-            const int64_t second_number = (second_index >= 0) ? char2int(other.digits.at((size_t)second_index)) : 0;
+            const int64_t second_number = (second_index >= 0) ? char2int(other.digits().at((size_t)second_index)) : 0;
             const int64_t summation = first_number + second_number + carryover;
 
             // Addition requires a carryover of 1 when the summation exceeds 9
@@ -204,15 +225,16 @@ public:
         }
 
         // Case 5 (Base case): Computes x - y when x and y are both positive and x >= y.
+        std::string &digits = mutable_digits();
         // Second_index is int64_t rather than uint64_t due to the (second_index >= 0) check below
-        int64_t second_index = (int64_t)other.digits.size() - 1;
+        int64_t second_index = (int64_t)other.digits().size() - 1;
         int64_t carryover = 0;
 
         // The following is the typical algorithm for subtraction
         for (std::string::reverse_iterator rit = digits.rbegin(); rit != digits.rend(); rit++)
         {
             const int64_t first_number = char2int(*rit) - carryover;
-            const int64_t second_number = (second_index >= 0) ? char2int(other.digits.at((size_t)second_index)) : 0;
+            const int64_t second_number = (second_index >= 0) ? char2int(other.digits().at((size_t)second_index)) : 0;
 
             if (first_number < second_number)
             {
@@ -244,6 +266,7 @@ public:
      */
     Bigint &operator*=(const Bigint &other)
     {
+        const std::string &digits = this->digits();
         Bigint tmp;
         uint64_t padded_zeros = 0;
 
@@ -251,7 +274,7 @@ public:
         // When performing multiplication such as the example shown below, the following for loop iterates backwards through other.digits (17 in this case)
         //  5380  <-- this
         // x  17  <-- other
-        for (std::string::const_reverse_iterator other_rit = other.digits.rbegin(); other_rit != other.digits.rend(); other_rit++)
+        for (std::string::const_reverse_iterator other_rit = other.digits().rbegin(); other_rit != other.digits().rend(); other_rit++)
         {
             const int64_t first_number = char2int(*other_rit);
             if (first_number == 0)
@@ -307,7 +330,7 @@ public:
      */
     bool operator==(const Bigint &other) const
     {
-        return (digits == other.digits && is_negative == other.is_negative);
+        return (is_negative == other.is_negative && (shared == other.shared || digits() == other.digits()));
     }
 
     /**
@@ -340,15 +363,15 @@ public:
         if (is_negative && other.is_negative)
         {
             // If sizes are different, the larger size Bigint is the smaller number (e.g. -40000 < -40)
-            if (digits.size() != other.digits.size())
-                return digits.size() > other.digits.size();
+            if (digits().size() != other.digits().size())
+                return digits().size() > other.digits().size();
 
             // Otherwise, loop through the string of digits from most significant digit to least significant digit
             // Whichever Bigint object has a larger digit is the smaller number (e.g. -5345 < -5335. In the 3rd iteration of the loop, 4 > 3)
-            for (uint64_t i = 0; i < digits.size(); i++)
+            for (uint64_t i = 0; i < digits().size(); i++)
             {
-                if (digits.at(i) != other.digits.at(i))
-                    return char2int(digits.at(i)) > char2int(other.digits.at(i));
+                if (digits().at(i) != other.digits().at(i))
+                    return char2int(digits().at(i)) > char2int(other.digits().at(i));
             }
 
             // If both objects have the same size and identical digits, they are equal and neither object is smaller than the other
@@ -357,14 +380,14 @@ public:
 
         // Case 4: x < y. Both numbers are positive - need to investigate further
         // If sizes are different, the larger size Bigint is the larger number (e.g. 40 < 40000)
-        if (digits.size() != other.digits.size())
-            return digits.size() < other.digits.size();
+        if (digits().size() != other.digits().size())
+            return digits().size() < other.digits().size();
         // Otherwise, loop through the string of digits from most significant digit to least significant digit
         // Whichever Bigint object has a larger digit is the larger number (e.g. 4319 > 4309. In the 3rd iteration of the loop, 1 > 0)
-        for (uint64_t i = 0; i < digits.size(); i++)
+        for (uint64_t i = 0; i < digits().size(); i++)
         {
-            if (digits.at(i) != other.digits.at(i))
-                return char2int(digits.at(i)) < char2int(other.digits.at(i));
+            if (digits().at(i) != other.digits().at(i))
+                return char2int(digits().at(i)) < char2int(other.digits().at(i));
         }
 
         // If both objects have the same size and identical digits, they are equal and neither object is smaller than the other
@@ -412,7 +435,12 @@ public:
      */
     Bigint &operator=(const Bigint &other)
     {
-        digits = other.digits;
+        if (shared != other.shared)
+        {
+            other.shared->reference_count.fetch_add(1, std::memory_order_relaxed);
+            release();
+            shared = other.shared;
+        }
         is_negative = other.is_negative;
         return *this;
     }
@@ -424,6 +452,54 @@ public:
     friend std::ostream &operator<<(std::ostream &out, const Bigint &b);
 
 private:
+    /**
+     * @brief Reference-counted buffer of digits that is shared between copies of a Bigint object
+     *
+     */
+    struct SharedDigits
+    {
+        explicit SharedDigits(std::string string_of_digits) : digits(std::move(string_of_digits)) {}
+
+        std::atomic<uint64_t> reference_count{1};
+        std::string digits;
+    };
+
+    /**
+     * @brief Read-only access to the magnitude of the current Bigint object, which may be shared with other Bigint objects
+     *
+     * @return Reference to the string of digits
+     */
+    const std::string &digits() const { return shared->digits; }
+
+    /**
+     * @brief Writable access to the magnitude of the current Bigint object. If the buffer is shared with other Bigint objects, the
+     * digits are first copied into a buffer owned only by the current object so that the other objects are unaffected
+     *
+     * @return Reference to the string of digits
+     */
+    std::string &mutable_digits()
+    {
+        // The acquire load pairs with the release in release() so that reads made through other copies before they let go of the
+        // buffer happen before the writes made through the returned reference
+        if (shared->reference_count.load(std::memory_order_acquire) != 1)
+        {
+            SharedDigits *copy = new SharedDigits(shared->digits);
+            release();
+            shared = copy;
+        }
+        return shared->digits;
+    }
+
+    /**
+     * @brief Drops the current object's reference to its buffer of digits and frees the buffer if it was the last reference
+     *
+     */
+    void release()
+    {
+        if (shared->reference_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete shared;
+    }
+
     /**
      * @brief Converts an input digit character ('0' - '9') into 64-bit integer. Look at ascii-code.com/ for conversion
      *
@@ -459,10 +535,10 @@ private:
     bool is_negative = false;
 
     /**
-     * @brief Used to store the magnitude of the current Bigint object, without any information of sign
+     * @brief Used to store the magnitude of the current Bigint object, without any information of sign. Shared between copies
      *
      */
-    std::string digits = "";
+    SharedDigits *shared = nullptr;
 };
 
 /**
@@ -525,9 +601,9 @@ Bigint operator-(Bigint b)
  */
 std::ostream &operator<<(std::ostream &out, const Bigint &b)
 {
-    if (b.digits == "0")
-        return (out << b.digits);
+    if (b.digits() == "0")
+        return (out << b.digits());
     const char sign = b.is_negative ? '-' : '+';
-    out << sign << b.digits;
+    out << sign << b.digits();
     return out;
 }
@@ -10,6 +10,8 @@
 
 #include "bigint.hpp"
 #include <iostream>
+#include <thread>
+#include <vector>
 
 int main()
 {
@@ -138,4 +140,74 @@ int main()
     {
         std::cerr << e.what() << '\n';
     }
+
+    // Copy-on-write demonstration:
+    std::cout << "\n\nCopy-on-write demonstration: \n";
+    try
+    {
+        Bigint a("43857902378459234");
+        Bigint b = a;
+        std::cout << "a is: " << a << '\n';
+        std::cout << "b is: " << b << "\n\n";
+
+        b += Bigint(1);
+        std::cout << "a is: " << a << '\n';
+        std::cout << "b is: " << b << "\n\n";
+
+        // Copies that share a buffer with the object they modify
+        std::cout << std::boolalpha;
+        Bigint c = a;
+        c += c;
+        std::cout << "c = a; c += c --> " << (c == Bigint("87715804756918468")) << '\n';
+        c = a;
+        c -= c;
+        std::cout << "c = a; c -= c --> " << (c == Bigint()) << '\n';
+        c = a;
+        c *= c;
+        std::cout << "c = a; c *= c --> " << (c == Bigint("1923515601038460134765527799866756")) << '\n';
+        std::cout << "a is unchanged --> " << (a == Bigint("43857902378459234")) << "\n\n";
+
+        // Hand copies of one large Bigint to several threads. Even-numbered workers only read their copy, while odd-numbered
+        // workers modify theirs, which detaches them from the shared buffer. original holds the same value in a separate buffer,
+        // so comparisons against it read the digits rather than just matching buffers
+        Bigint large("98765432109876543210");
+        for (int i = 0; i < 4; i++)
+            large *= large;
+        const Bigint original = large * Bigint(1);
+
+        const int64_t worker_count = 8;
+        std::vector<Bigint> results(worker_count);
+        std::vector<std::thread> workers;
+        for (int64_t t = 0; t < worker_count; t++)
+        {
+            workers.emplace_back([&large, &original, &results, t]()
+            {
+                Bigint copy = large;
+                for (int i = 0; i < 100; i++)
+                {
+                    if (t % 2 == 1)
+                        copy += Bigint(1);
+                    else if (copy != original)
+                    {
+                        results[t] = Bigint(-1);
+                        return;
+                    }
+                }
+                results[t] = copy - original;
+            });
+        }
+        for (std::thread &worker : workers)
+            worker.join();
+
+        bool workers_correct = true;
+        for (int64_t t = 0; t < worker_count; t++)
+            workers_correct = workers_correct && (results[t] == Bigint(t % 2 == 1 ? 100 : 0));
+        std::cout << "Readers saw the shared value and writers detached correctly --> " << workers_correct << '\n';
+        std::cout << "Large Bigint shared with " << worker_count << " threads is unchanged --> " << (large == original) << '\n';
+        std::cout << std::noboolalpha;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << '\n';
+    }
 }